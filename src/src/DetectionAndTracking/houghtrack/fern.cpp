@@ -30,6 +30,38 @@ Fern::Fern( const Size& baseSize, unsigned int numTests, unsigned int numChannel
 	m_nodeTable.clear();
 }
 
+Fern::Fern( istream& is )
+{
+	unsigned int numNodes = 0;
+	is >> m_baseSize.width >> m_baseSize.height >> m_numTests >> numPos >> numNeg;
+	for(unsigned int t = 0; t < m_numTests && is; t++)
+		m_tests.push_back( RandomTest(is) );
+
+	is >> numNodes;
+	for(unsigned int n = 0; n < numNodes && is; n++)
+	{
+		unsigned int idx = 0;
+		is >> idx;
+		m_nodeTable.insert( make_pair(idx, Node(is)) );
+	}
+}
+
+void Fern::write(ostream& os) const
+{
+	os << m_baseSize.width << ' ' << m_baseSize.height << ' ' << m_numTests << ' '
+	   << numPos << ' ' << numNeg << '\n';
+	for(unsigned int t = 0; t < m_tests.size(); t++)
+		m_tests[t].write(os);
+
+	os << m_nodeTable.size() << '\n';
+	map< unsigned int, Node >::const_iterator it;
+	for(it = m_nodeTable.begin(); it != m_nodeTable.end(); ++it)
+	{
+		os << (*it).first << ' ';
+		(*it).second.write(os);
+	}
+}
+
 Fern::~Fern()
 {
 	m_tests.clear();
@@ -30,6 +30,17 @@ public:
 		B = cv::Point(randIntFromRange(0,baseSize.width), randIntFromRange(0,baseSize.height));
 	}
 
+	//! read a test written by write()
+	RandomTest(std::istream& is)
+	{
+		is >> channel >> A.x >> A.y >> B.x >> B.y;
+	}
+
+	void write(std::ostream& os) const
+	{
+		os << channel << ' ' << A.x << ' ' << A.y << ' ' << B.x << ' ' << B.y << '\n';
+	}
+
 	inline bool eval( const Features& ft, const cv::Point& base) const
 	{
 		cv::Mat img = ft.getChannel(channel);
@@ -70,6 +81,37 @@ public:
 		MapStep = n.MapStep;
 	};
 
+	//! read a node written by write()
+	Node(std::istream& is)
+	{
+		int n = 0;
+		is >> MapSize >> MapStep >> numPos >> numNeg >> probPos >> n;
+		voteMap = cv::Mat( MapSize, MapSize, CV_32FC1, cv::Scalar(0.0f) );
+		for(int v = 0; v < n; v++)
+		{
+			int idx = -1;
+			float val = 0.0f;
+			is >> idx >> val;
+			if(idx >= 0 && idx < MapSize*MapSize)
+				voteMap.at<float>(idx / MapSize, idx % MapSize) = val;
+		}
+	};
+
+	//! write the node; the vote map is sparse, so only the cells with votes are written
+	void write(std::ostream& os) const
+	{
+		os << MapSize << ' ' << MapStep << ' ' << numPos << ' ' << numNeg << ' ' << probPos
+		   << ' ' << cv::countNonZero(voteMap);
+		for(int y = 0; y < MapSize; y++)
+			for(int x = 0; x < MapSize; x++)
+			{
+				const float val = voteMap.at<float>(y, x);
+				if(val != 0.0f)
+					os << ' ' << y*MapSize + x << ' ' << val;
+			}
+		os << '\n';
+	};
+
  
 	float numPos, numNeg;
 	float probPos;
@@ -145,8 +187,13 @@ class Fern
 {
 public:
 	Fern( const cv::Size& baseSize, unsigned int numTests, unsigned int numChannels );
+	//! read a fern written by write()
+	Fern( std::istream& is );
 	~Fern();
 
+	//! write the tests and the learned nodes
+	void write(std::ostream& os) const;
+
 	void evaluate(Features& ft, const cv::Rect& ROI, cv::Mat& result, int stepSize = 1, float threshold = 0.5f) const;
 	void update(Features& ft, const cv::Point& pos, int label, const cv::Point& center);
 	void forget(const double& factor);
@@ -202,7 +249,7 @@ bool sortFernsDesc (const Fern& A, const Fern& B);
 class Ferns
 {
 public:
-	Ferns()
+	Ferns() : isSorted(false)
 	{
 	};
 
@@ -292,6 +339,25 @@ public:
         return m_ferns.at(0).getBaseSize();
     };
 
+	//! write all ferns in their current order
+	void write(std::ostream& os) const
+	{
+		os << m_ferns.size() << ' ' << isSorted << '\n';
+		for(unsigned int f = 0; f < m_ferns.size(); f++)
+			m_ferns[f].write(os);
+	};
+
+	//! replace the ferns with those written by write()
+	void read(std::istream& is)
+	{
+		clear();
+		m_ferns.clear();
+		unsigned int n = 0;
+		is >> n >> isSorted;
+		for(unsigned int f = 0; f < n && is; f++)
+			m_ferns.push_back( Fern(is) );
+	};
+
 	void printStatistics()
 	{
 		if(!isSorted)